@@ -151,6 +151,7 @@ cat >loadtest.txt <<EOF
 name: built-in
 description: Alternative 1
 Alternative-Group: alternative
+Priority: 10
 version: 1
 EOF
 
@@ -161,6 +162,7 @@ system/built-in:start=forking:stop=manual
 system/built-in:alternative-group=system/alternative
 system/built-in:description=Alternative 1
 system/built-in:sigterm:notify=parents
+system/built-in:priority=10
 EOF
 diff -U 3 loadtest.expected loadtest.out
 
@@ -384,6 +386,89 @@ built-in:stopping_after dep8
 EOF
 diff -U 3 loadtest.txt loadtest.out
 
+cat >loadtest.txt <<EOF
+name: built-in
+starting:
+    command: /bin/true
+    timeout: 2.5
+stopping:
+    command: /bin/false
+    timeout: 0.125
+version: 1
+EOF
+$VALGRIND ./testprocloader loadtest <loadtest.txt >loadtest.out
+cat >loadtest.txt <<EOF
+built-in:start=forking:stop=manual
+built-in:starting:/bin/true
+built-in:stopping:/bin/false
+built-in:starting_timeout 2.5
+built-in:stopping_timeout 0.125
+built-in:sigterm:notify=all
+EOF
+diff -U 3 loadtest.txt loadtest.out
+
+cat >loadtest.txt <<EOF
+name: built-in
+starting:
+    command: /bin/true
+    timeout: 2.0005
+version: 1
+EOF
+$VALGRIND ./testprocloader loadtest <loadtest.txt >loadtest.out 2>&1 || true
+cat >loadtest.txt <<EOF
+error: built-in: starting/timeout: invalid timeout value
+EOF
+diff -U 3 loadtest.txt loadtest.out
+
+cat >loadtest.txt <<EOF
+name: built-in
+pressure:
+    memory:
+        stall: 0.15
+        action: freeze
+    io:
+        stall: 0.5
+        window: 2
+    oom:
+        action: stop
+version: 1
+EOF
+$VALGRIND ./testprocloader loadtest <loadtest.txt >loadtest.out
+cat >loadtest.txt <<EOF
+built-in:start=forking:stop=manual
+built-in:sigterm:notify=parents
+built-in:pressure:memory 0.15/1 freeze
+built-in:pressure:io 0.5/2 log
+built-in:pressure:oom stop
+EOF
+diff -U 3 loadtest.txt loadtest.out
+
+cat >loadtest.txt <<EOF
+name: built-in
+pressure:
+    cpu:
+        stall: 2
+version: 1
+EOF
+$VALGRIND ./testprocloader loadtest <loadtest.txt >loadtest.out 2>&1 || true
+cat >loadtest.txt <<EOF
+error: built-in: pressure/cpu: stall must be more than 0, and not more than the window
+EOF
+diff -U 3 loadtest.txt loadtest.out
+
+cat >loadtest.txt <<EOF
+name: built-in
+pressure:
+    oom:
+        action: reboot
+version: 1
+EOF
+$VALGRIND ./testprocloader loadtest <loadtest.txt >loadtest.out 2>&1 || true
+cat >loadtest.txt <<EOF
+error: built-in: pressure/oom: invalid action
+EOF
+diff -U 3 loadtest.txt loadtest.out
+
 cat >loadtest.txt <<EOF
 name: built-in
 required-by: one
@@ -541,6 +626,16 @@ EOF
 
 diff -U 3 loadtest.txt loadtest.out
 
+$VALGRIND ./testprocloader loadallcachetest globaldir localdir overridedir localdir/unit3-runlevel2 >loadtest.out
+
+cat >loadtest.txt <<EOF
+unit2-runlevel1: cached
+unit3-runlevel2: reloaded
+unit4-disabled: cached
+EOF
+
+diff -U 3 loadtest.txt loadtest.out
+
 ./testprocloader testrunlevelconfig loadtest.txt
 
 cat >loadtest.txt <<EOF